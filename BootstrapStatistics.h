@@ -0,0 +1,96 @@
+/**
+ * @file BootstrapStatistics.h
+ * @brief Header file of the BootstrapStatistics class.
+ * @author Daniel Ingham
+ * @date 2025-06-20
+ */
+#ifndef INCLUDE_INCLUDE_BOOTSTRAP_STATISTICS_H_
+#define INCLUDE_INCLUDE_BOOTSTRAP_STATISTICS_H_
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
+#include <vector>  // std::vector
+
+class DataHandler;
+
+/**
+ * @class BootstrapStatistics
+ * @brief Bootstrap confidence intervals of the mean, variance and
+ * inter-quartile range of each robot's sensor errors.
+ * @details The errors of each robot and sensor channel are resampled with
+ * replacement, and the statistics of every resample are calculated. The
+ * confidence intervals are the percentiles of these statistics.
+ *
+ * The errors are sorted once, after which a resample is represented by the
+ * number of times each sorted error is drawn. A single pass over the counts
+ * then gives the mean, variance and quartiles of the resample, without
+ * sorting it. The quartiles are the smallest errors whose cumulative count
+ * reaches a quarter and three quarters of the samples.
+ *
+ * The resamples are split into blocks that are calculated in parallel. Each
+ * block draws from its own random stream of the seed, and reuses one count
+ * buffer for all its resamples, so the intervals are reproducible regardless
+ * of the number of threads.
+ * @note The errors are the sensor errors of Robot::error, so measurement
+ * outliers have already been removed.
+ */
+class BootstrapStatistics {
+public:
+  /**
+   * @brief The sensor channels whose errors are resampled.
+   */
+  enum Channel {
+    FORWARD_VELOCITY = 0,
+    ANGULAR_VELOCITY = 1,
+    RANGE = 2,
+    BEARING = 3
+  };
+
+  /**
+   * @brief A statistic of the errors and its confidence interval.
+   */
+  struct Interval {
+    double estimate = 0.0; ///< The statistic of the original errors.
+    double lower = 0.0;    ///< Lower bound of the confidence interval.
+    double upper = 0.0;    ///< Upper bound of the confidence interval.
+  };
+
+  /**
+   * @brief The confidence intervals of a robot's sensor channel.
+   */
+  struct Estimate {
+    unsigned long count = 0; ///< The number of errors.
+    Interval mean;           ///< Mean of the errors.
+    Interval variance;       ///< Sample variance of the errors.
+    Interval iqr;            ///< Inter-quartile range of the errors.
+  };
+
+  explicit BootstrapStatistics(const DataHandler &,
+                               unsigned long resamples = 2000,
+                               double confidence = 0.95,
+                               std::uint32_t seed = 0,
+                               unsigned int threads = 0);
+
+  /* Getters */
+  const Estimate &getEstimate(unsigned short, Channel) const;
+  unsigned long getNumberOfResamples() const;
+  double getConfidence() const;
+  unsigned short getNumberOfRobots() const;
+
+private:
+  /**
+   * @brief The number of sensor channels.
+   */
+  static constexpr std::size_t TOTAL_CHANNELS = 4;
+
+  unsigned long resamples_;
+  double confidence_;
+  unsigned short total_robots_;
+
+  /**
+   * @brief The estimates, indexed by robot and then channel.
+   */
+  std::vector<Estimate> estimates_;
+};
+
+#endif // INCLUDE_INCLUDE_BOOTSTRAP_STATISTICS_H_
@@ -7,14 +7,26 @@
 #ifndef INCLUDE_INCLUDE_DATA_HANDLER_H_
 #define INCLUDE_INCLUDE_DATA_HANDLER_H_
 
-#include <cmath>   // std::floor
-#include <cstdlib> // system
-#include <string>  // std::string
-#include <vector>  // std::vector
-
+#include <algorithm>  // std::fill
+#include <atomic>     // std::atomic
+#include <cmath>      // std::floor
+#include <cstdint>    // std::uint32_t
+#include <cstdlib>    // system
+#include <functional> // std::function
+#include <future>     // std::shared_future
+#include <memory>     // std::shared_ptr, std::unique_ptr
+#include <mutex>      // std::mutex
+#include <stdexcept>  // std::runtime_error
+#include <string>     // std::string
+#include <vector>     // std::vector
+
+#include "Event.h"
 #include "Landmark.h"
 #include "Robot.h"
 #include "Simulator.h"
+#include "SpscQueue.h"
+#include "ThreadPool.h"
+#include "VisibilityIndex.h"
 
 /**
  * @class DataHandler
@@ -26,6 +38,21 @@
  */
 class DataHandler {
 public:
+  /**
+   * @brief Products derived from the synced data. The sensor errors depend on
+   * the groundtruth odometry and measurements, and the error statistics
+   * depend on the sensor errors. The visibility index is only calculated when
+   * it is required explicitly, so it is not part of ALL_PRODUCTS.
+   */
+  enum Product : unsigned {
+    GROUNDTRUTH_ODOMETRY = 1U << 0,     ///< Robot::groundtruth odometry.
+    GROUNDTRUTH_MEASUREMENTS = 1U << 1, ///< Robot::groundtruth measurements.
+    SENSOR_ERROR = 1U << 2,             ///< Robot::error without outliers.
+    ERROR_STATISTICS = 1U << 3,         ///< Robot sensor error statistics.
+    ALL_PRODUCTS = (1U << 4) - 1,
+    VISIBILITY_INDEX = 1U << 4 ///< DataHandler::getVisibilityIndex.
+  };
+
   /* Constructors */
   DataHandler();
   explicit DataHandler(const std::string &,
@@ -34,6 +61,34 @@ public:
 
   DataHandler(const unsigned long int, double, const unsigned short,
               const unsigned short, const std::string &output_directory = "");
+  DataHandler(const unsigned long int, double, const unsigned short,
+              const unsigned short, std::uint32_t,
+              const std::string &output_directory = "");
+  virtual ~DataHandler() = default;
+
+  /* Asynchronous Construction */
+  static std::shared_future<std::shared_ptr<DataHandler>>
+  loadDataSet(const std::string &, const std::string &output_directory = "",
+              const double &sampling_period = 0.02,
+              std::function<void(DataHandler &)> on_ready = nullptr);
+
+  static std::vector<std::shared_ptr<DataHandler>>
+  loadDataSets(const std::vector<std::string> &,
+               const std::string &output_directory = "",
+               const double &sampling_period = 0.02, unsigned int threads = 0);
+
+  /* Batch Simulation */
+  static void simulateTrials(
+      unsigned long, unsigned long, double, unsigned short, unsigned short,
+      const std::function<void(unsigned long, DataHandler &)> &,
+      std::uint32_t seed = 0, bool reuse_landmarks = false,
+      unsigned int threads = 0, const std::string &output_directory = "");
+
+  static std::vector<std::shared_ptr<DataHandler>>
+  simulateTrials(unsigned long, unsigned long, double, unsigned short,
+                 unsigned short, std::uint32_t seed = 0,
+                 bool reuse_landmarks = false, unsigned int threads = 0,
+                 const std::string &output_directory = "");
 
   /* Setters */
   void setDataSet(const std::string &, const std::string &output_directory = "",
@@ -42,24 +97,62 @@ public:
   void setSimulation(unsigned long int, double, const unsigned short,
                      const unsigned short,
                      const std::string &output_directory = "");
+  void setSimulation(unsigned long int, double, const unsigned short,
+                     const unsigned short, std::uint32_t,
+                     const std::string &output_directory = "");
+
+  void setCollisionAvoidance(bool, double distance = 0.6);
+  void setOcclusion(bool, double robot_radius = 0.2);
+  void addWall(double, double, double, double);
+  void setSensorModel(const Simulator::SensorModel &);
+  void setLazyEvaluation(bool);
+  void setQuantileSketch(unsigned int);
+
+  void resample(const double &);
+
+  /* Derived Products */
+  void require(unsigned products = ALL_PRODUCTS) const;
+  bool isAvailable(unsigned) const;
+  const VisibilityIndex &getVisibilityIndex() const;
+
+  /* Data Edits */
+  void setLandmarkPosition(unsigned short, double, double);
+  void setRawMeasurements(unsigned short, double, double,
+                          const std::vector<Robot::Measurement> &);
 
   /* Getters */
   std::vector<Landmark> &getLandmarks();
   std::vector<Robot> &getRobots();
   std::vector<unsigned short int> &getBarcodes();
 
-  double getSamplePeriod();
+  const std::vector<Landmark> &getLandmarks() const;
+  const std::vector<Robot> &getRobots() const;
+  const std::vector<unsigned short int> &getBarcodes() const;
+
+  double getSamplePeriod() const;
 
-  unsigned short getNumberOfRobots();
-  unsigned short getNumberOfLandmarks();
-  unsigned short getNumberOfBarcodes();
-  unsigned long getNumberOfSyncedDatapoints();
+  unsigned short getNumberOfRobots() const;
+  unsigned short getNumberOfLandmarks() const;
+  unsigned short getNumberOfBarcodes() const;
+  unsigned long getNumberOfSyncedDatapoints() const;
 
-  int getID(unsigned short int);
+  virtual int getID(unsigned short int) const;
+  Robot::ErrorSketches getErrorSketches() const;
+  Robot::ErrorCovariance getVelocityErrorCovariance() const;
+  Robot::ErrorCovariance getMeasurementErrorCovariance() const;
+
+  std::size_t getMemoryUsage() const;
+  void compact();
+
+  std::vector<Event> getSyncedEvents(bool include_groundtruth = false) const;
+
+  /* Filter Consistency */
+  std::vector<double> getAverageNEES() const;
 
   /* Output of Extracted Data */
   void saveExtractedData();
   void saveStateError();
+  void saveRelativeGeometry(unsigned int threads = 0);
 
   void plotExtractedData(std::string file_type = "png");
   void plotPDFs(std::string file_type = "png");
@@ -69,6 +162,21 @@ public:
 
   void plotInferenceError(std::string file_type = "png");
 
+  /* Multi-process Sharing */
+  void publishSharedMemory(const std::string &) const;
+
+  /* Multi-threaded Delivery */
+  void fanOutEvents(const std::vector<SpscQueue<Event> *> &,
+                    bool include_messages = true) const;
+
+protected:
+  virtual void checkFleetSize(unsigned short, unsigned short) const;
+  virtual void setBarcodeTable();
+
+  template <typename Queues, typename Delivered, typename GetIndex>
+  void deliverEvents(const Queues &, Delivered &, GetIndex,
+                     bool include_messages) const;
+
 private:
   /**
    * @brief Folder location for the dataset.
@@ -147,12 +255,62 @@ private:
    */
   std::vector<unsigned short int> barcodes_;
 
+  /**
+   * @brief The synced measurements of each robot that observe each landmark,
+   * indexed by robot and then by landmark. Set with the groundtruth
+   * measurements.
+   */
+  std::vector<std::vector<std::vector<std::size_t>>> landmark_dependencies_;
+
   /**
    * @brief Simulator class responsible for creating odometry, and measurement
    * data for the robots, and assigning positions to the landmarks.
    */
   Simulator simulator;
 
+  /**
+   * @brief Whether DataHandler::setDataSet leaves the derived products to be
+   * calculated on demand by DataHandler::require.
+   */
+  bool lazy_ = false;
+
+  /**
+   * @brief The size parameter of the robots' error sketches. Zero disables
+   * the sketches.
+   */
+  unsigned int sketch_size_ = 0;
+
+  /**
+   * @brief The DataHandler::Product flags of the products that have been
+   * calculated.
+   */
+  mutable std::atomic<unsigned> available_products_{0U};
+
+  /**
+   * @brief Serialises the calculation of the derived products.
+   */
+  mutable std::mutex products_mutex_;
+
+  /**
+   * @brief Groundtruth visibility of the robots and landmarks, calculated by
+   * DataHandler::getVisibilityIndex.
+   */
+  std::unique_ptr<VisibilityIndex> visibility_index_;
+
+  /**
+   * @brief Thread pool on which the per-file and per-robot stages of the data
+   * processing are executed. If nullptr, the stages are executed sequentially
+   * on the calling thread.
+   */
+  ThreadPool *pool_ = nullptr;
+
+  void parallelFor(std::size_t, const std::function<void(std::size_t)> &);
+
+  static void runTrials(
+      unsigned long, unsigned long, double, unsigned short, unsigned short,
+      const std::function<void(unsigned long, std::shared_ptr<DataHandler>)> &,
+      std::uint32_t, bool, unsigned int, const std::string &);
+
   void setOutputDirectory(const std::string &, const std::string &);
 
   /* Extracting Data from the Dataset */
@@ -164,9 +322,18 @@ private:
 
   /* Processing the Data for Filtering */
   void syncData(const double &);
+  void syncMeasurement(const Robot::Measurement &, const double &,
+                       std::vector<Robot::Measurement> &) const;
 
   void calculateGroundtruthOdometry();
   void calculateGroundtruthMeasurement();
+  void calculateProducts(unsigned);
+  static unsigned addDependencies(unsigned);
+
+  Robot::Measurement
+  getGroundtruthMeasurement(std::size_t, const Robot::Measurement &) const;
+  void setLandmarkDependencies(std::size_t);
+  void updateErrors(const std::vector<char> &);
 
   void createStatePlotDirectory();
   void createMeasurementPlotDirectories();
@@ -182,9 +349,60 @@ private:
 
   void saveRobotErrorStatistics();
   void saveLandmarks();
-
-  void relativeRobotDistance();
-  void relativeLandmarkDistance();
 };
 
+/**
+ * @brief Delivers the synced events of each robot into its own queue, and
+ * closes the queues once all events have been delivered.
+ * @details Shared by DataHandler::fanOutEvents and the fixed-size overload of
+ * FixedDataHandler, which differ only in their containers and ID lookup.
+ * @param[in] queues one non-null queue per robot, indexed by robot.
+ * @param[in,out] delivered one flag per robot, used to deliver a measurement to
+ * each measured robot only once.
+ * @param[in] get_robot_index returns the index of the robot with the given
+ * barcode, or a negative value if the barcode is not a robot.
+ * @param[in] include_messages whether a measurement of another robot is also
+ * delivered to the measured robot as an Event::MESSAGE.
+ */
+template <typename Queues, typename Delivered, typename GetIndex>
+void DataHandler::deliverEvents(const Queues &queues, Delivered &delivered,
+                                GetIndex get_robot_index,
+                                bool include_messages) const {
+  for (const auto *queue : queues) {
+    if (queue == nullptr) {
+      throw std::runtime_error("Event queues cannot be null.");
+    }
+  }
+
+  for (const Event &event : getSyncedEvents()) {
+    queues[event.robot]->push(event);
+
+    if (!include_messages || event.type != Event::MEASUREMENT) {
+      continue;
+    }
+
+    /* Share the measurement with every robot that was measured, once. */
+    const std::vector<unsigned short> &subjects =
+        robots_[event.robot].synced.measurements[event.index].subjects;
+
+    std::fill(delivered.begin(), delivered.end(), false);
+    delivered[event.robot] = true;
+
+    for (unsigned short barcode : subjects) {
+      const int subject_index = get_robot_index(barcode);
+      if (subject_index < 0 || delivered[subject_index]) {
+        continue;
+      }
+
+      delivered[subject_index] = true;
+      queues[subject_index]->push(
+          Event{event.time, Event::MESSAGE, event.robot, event.index});
+    }
+  }
+
+  for (auto *queue : queues) {
+    queue->close();
+  }
+}
+
 #endif // INCLUDE_INCLUDE_DATA_EXTRACTOR_H_
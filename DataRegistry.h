@@ -0,0 +1,111 @@
+/**
+ * @file DataRegistry.h
+ * @brief Header file of the DataRegistry class.
+ * @author Daniel Ingham
+ * @date 2025-05-14
+ */
+#ifndef INCLUDE_INCLUDE_DATA_REGISTRY_H_
+#define INCLUDE_INCLUDE_DATA_REGISTRY_H_
+
+#include <cstddef> // std::size_t
+#include <future>  // std::shared_future
+#include <list>    // std::list
+#include <map>     // std::map
+#include <memory>  // std::shared_ptr
+#include <mutex>   // std::mutex
+#include <string>  // std::string
+
+#include "DataHandler.h"
+
+/**
+ * @class DataRegistry
+ * @brief Process-wide cache of shared, read-only DataHandler instances.
+ * @details Datasets are loaded on demand the first time they are requested.
+ * Concurrent requests for the same dataset wait on the same load instead of
+ * extracting the dataset again. When the memory held by the registry exceeds
+ * the memory budget, the least recently used datasets are released.
+ * @note Released datasets remain valid for as long as a caller holds the
+ * std::shared_ptr returned by DataRegistry::getDataSet.
+ */
+class DataRegistry {
+public:
+  DataRegistry(const DataRegistry &) = delete;
+  DataRegistry &operator=(const DataRegistry &) = delete;
+
+  static DataRegistry &getInstance();
+
+  std::shared_ptr<const DataHandler>
+  getDataSet(const std::string &, const double &sampling_period = 0.02,
+             const std::string &output_directory = "", bool lazy = false);
+
+  void setMemoryBudget(std::size_t);
+  std::size_t getMemoryBudget() const;
+  std::size_t getMemoryUsage() const;
+  std::size_t getNumberOfDataSets() const;
+
+  void clear();
+
+private:
+  DataRegistry();
+
+  /**
+   * @brief The values that uniquely identify a processed dataset.
+   */
+  struct Key {
+    std::string dataset;          ///< Dataset folder name.
+    double sampling_period;       ///< Resampling period [s].
+    std::string output_directory; ///< Output directory of the DataHandler.
+    bool lazy;                    ///< Derived products calculated on demand.
+
+    bool operator<(const Key &) const;
+  };
+
+  /**
+   * @brief A dataset that is either being loaded or is ready to be used.
+   */
+  struct Entry {
+    /** @brief Shared between all requests for the same key. */
+    std::shared_future<std::shared_ptr<const DataHandler>> data;
+    /** @brief Position of the key in DataRegistry::recently_used_. */
+    std::list<Key>::iterator usage;
+    /** @brief Memory used by the dataset [bytes]. Zero while loading. */
+    std::size_t memory = 0;
+    /** @brief Whether the dataset has finished loading. */
+    bool ready = false;
+    /** @brief Identifies the load that created the entry. */
+    unsigned long load_id = 0;
+  };
+
+  /**
+   * @brief All loaded and loading datasets.
+   */
+  std::map<Key, Entry> entries_;
+
+  /**
+   * @brief Keys ordered from the most recently used to the least recently
+   * used.
+   */
+  std::list<Key> recently_used_;
+
+  /**
+   * @brief The maximum memory the registry holds on to [bytes]. A value of
+   * zero denotes an unlimited budget.
+   */
+  std::size_t memory_budget_ = 0;
+
+  /**
+   * @brief The memory currently held by the registry [bytes].
+   */
+  std::size_t memory_usage_ = 0;
+
+  /**
+   * @brief The number of loads started, used to identify the entries.
+   */
+  unsigned long total_loads_ = 0;
+
+  mutable std::mutex mutex_;
+
+  void evict();
+};
+
+#endif // INCLUDE_INCLUDE_DATA_REGISTRY_H_
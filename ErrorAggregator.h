@@ -0,0 +1,97 @@
+/**
+ * @file ErrorAggregator.h
+ * @brief Header file of the ErrorAggregator class.
+ * @author Daniel Ingham
+ * @date 2025-05-28
+ */
+#ifndef INCLUDE_INCLUDE_ERROR_AGGREGATOR_H_
+#define INCLUDE_INCLUDE_ERROR_AGGREGATOR_H_
+
+#include <string> // std::string
+#include <vector> // std::vector
+
+#include "DataHandler.h"
+#include "QuantileSketch.h"
+#include "Robot.h"
+
+/**
+ * @class ErrorAggregator
+ * @brief Accumulates the state error of many Monte Carlo runs in memory.
+ * @details For every synced timestep, the mean and variance of the x,
+ * y, orientation and position errors are accumulated across runs. The
+ * distribution of the position and absolute orientation errors is
+ * additionally summarised with a QuantileSketch for every bin of timesteps,
+ * which bounds the memory regardless of the number of runs.
+ *
+ * Each worker thread accumulates its own runs, after which the aggregators
+ * are combined with ErrorAggregator::merge and saved to a single file.
+ * @note An ErrorAggregator is not thread safe. Use one aggregator per thread.
+ */
+class ErrorAggregator {
+public:
+  /**
+   * @brief Error components that are accumulated.
+   */
+  enum Component { X = 0, Y = 1, ORIENTATION = 2, POSITION = 3 };
+
+  ErrorAggregator(unsigned long, double, unsigned long bin_size = 50,
+                  unsigned int sketch_size = 64);
+
+  void addErrorSeries(const std::vector<Robot::State> &);
+  void addRun(const DataHandler &);
+  void merge(const ErrorAggregator &);
+
+  /* Getters */
+  unsigned long getNumberOfRuns() const;
+  unsigned long getNumberOfTimesteps() const;
+  unsigned long getCount(unsigned long) const;
+  double getMean(Component, unsigned long) const;
+  double getVariance(Component, unsigned long) const;
+  double getQuantile(Component, unsigned long, double) const;
+
+  /* Output */
+  void save(const std::string &) const;
+
+private:
+  /**
+   * @brief Running moments of an error component, indexed by timestep.
+   */
+  struct Moments {
+    std::vector<double> mean; ///< Running mean.
+    std::vector<double> m2;   ///< Running sum of squared deviations.
+  };
+
+  unsigned long total_timesteps_;
+  double sample_period_;
+  unsigned long bin_size_;
+  unsigned int sketch_size_;
+
+  /**
+   * @brief The number of error series accumulated.
+   */
+  unsigned long total_runs_ = 0;
+
+  /**
+   * @brief The number of samples at each timestep.
+   */
+  std::vector<unsigned long> count_;
+
+  /**
+   * @brief Moments indexed by ErrorAggregator::Component.
+   */
+  Moments moments_[4];
+
+  /**
+   * @brief Position error sketches indexed by bin.
+   */
+  std::vector<QuantileSketch> position_sketches_;
+
+  /**
+   * @brief Absolute orientation error sketches indexed by bin.
+   */
+  std::vector<QuantileSketch> orientation_sketches_;
+
+  const QuantileSketch &getSketch(Component, unsigned long) const;
+};
+
+#endif // INCLUDE_INCLUDE_ERROR_AGGREGATOR_H_
@@ -0,0 +1,38 @@
+/**
+ * @file Event.h
+ * @brief Header file of the Event struct.
+ * @author Daniel Ingham
+ * @date 2025-05-19
+ */
+#ifndef INCLUDE_INCLUDE_EVENT_H_
+#define INCLUDE_INCLUDE_EVENT_H_
+
+#include <cstddef> // std::size_t
+
+/**
+ * @struct Event
+ * @brief A single time stamped sensor reading of a robot.
+ * @details Events do not copy the sensor data. Instead, they reference the
+ * element in the robot's data vectors, which allows events to be passed
+ * through queues cheaply. The vector that is referenced depends on the event
+ * type:
+ * - Event::ODOMETRY: Robot::synced odometry.
+ * - Event::MEASUREMENT: Robot::synced measurements.
+ * - Event::GROUNDTRUTH: Robot::groundtruth states.
+ * - Event::MESSAGE: Robot::synced measurements of the measuring robot. The
+ *   event is delivered to a robot that appears among the measured subjects,
+ *   and models the measuring robot sharing its measurement with that robot.
+ */
+struct Event {
+  /**
+   * @brief The type of sensor reading.
+   */
+  enum Type { ODOMETRY = 0, MEASUREMENT = 1, GROUNDTRUTH = 2, MESSAGE = 3 };
+
+  double time;          ///< Synced time stamp of the reading [s].
+  Type type;            ///< The type of sensor reading.
+  unsigned short robot; ///< Index of the robot in DataHandler::robots_.
+  std::size_t index;    ///< Index of the reading in the referenced vector.
+};
+
+#endif // INCLUDE_INCLUDE_EVENT_H_
@@ -0,0 +1,260 @@
+/**
+ * @file FixedDataHandler.h
+ * @brief Header file of the FixedDataHandler class template.
+ * @author Daniel Ingham
+ * @date 2025-06-09
+ */
+#ifndef INCLUDE_INCLUDE_FIXED_DATA_HANDLER_H_
+#define INCLUDE_INCLUDE_FIXED_DATA_HANDLER_H_
+
+#include <algorithm> // std::max
+#include <array>     // std::array
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t
+#include <stdexcept> // std::runtime_error
+#include <string>    // std::string, std::to_string
+#include <vector>    // std::vector
+
+#include "DataHandler.h"
+#include "Event.h"
+#include "SpscQueue.h"
+
+/**
+ * @class FixedDataHandler
+ * @brief DataHandler for a fleet whose number of robots and landmarks is known
+ * at compile time.
+ * @details The barcodes of each dataset or simulation are copied into a
+ * fixed-size table indexed by barcode, so that FixedDataHandler::getID is a
+ * single array access instead of a search through DataHandler::getBarcodes.
+ * FixedDataHandler::getID overrides DataHandler::getID, so the processing in
+ * DataHandler uses the table as well. The size of every new dataset or
+ * simulation is checked against the template parameters before any data is
+ * replaced, including when it is set through a DataHandler reference.
+ *
+ * Only the barcode lookup and FixedDataHandler::fanOutEvents use fixed-size
+ * storage. The robots, landmarks and all other per-robot loops remain the
+ * dynamic containers of DataHandler.
+ *
+ * DataHandler remains the class to use for simulations of arbitrary size.
+ * @tparam ROBOTS the number of robots.
+ * @tparam LANDMARKS the number of landmarks.
+ */
+template <unsigned short ROBOTS, unsigned short LANDMARKS>
+class FixedDataHandler : public DataHandler {
+  static_assert(ROBOTS > 0, "A fleet requires at least one robot.");
+
+public:
+  static constexpr unsigned short TOTAL_ROBOTS = ROBOTS;
+  static constexpr unsigned short TOTAL_LANDMARKS = LANDMARKS;
+  static constexpr unsigned short TOTAL_BARCODES = ROBOTS + LANDMARKS;
+
+  /**
+   * @brief Size of the barcode table. The UTIAS barcodes have two digits, and
+   * the simulated barcodes are equal to the IDs.
+   */
+  static constexpr std::size_t BARCODE_TABLE_SIZE =
+      std::max<std::size_t>(100, TOTAL_BARCODES + 1);
+
+  /* Constructors */
+  FixedDataHandler() { id_table_.fill(-1); }
+
+  /**
+   * @brief Extracts and processes a dataset.
+   * @param[in] dataset the folder location of the dataset.
+   * @param[in] output_directory the folder location of the output data.
+   * @param[in] sampling_period the sample period used to sync the data [s].
+   */
+  explicit FixedDataHandler(const std::string &dataset,
+                            const std::string &output_directory = "",
+                            const double &sampling_period = 0.02)
+      : DataHandler(dataset, output_directory, sampling_period) {
+    initialise();
+  }
+
+  /**
+   * @brief Simulates a fleet with FixedDataHandler::TOTAL_ROBOTS robots and
+   * FixedDataHandler::TOTAL_LANDMARKS landmarks.
+   * @param[in] data_points the number of synced datapoints.
+   * @param[in] sample_period the sample period of the simulation [s].
+   * @param[in] output_directory the folder location of the output data.
+   */
+  FixedDataHandler(unsigned long data_points, double sample_period,
+                   const std::string &output_directory = "")
+      : DataHandler(data_points, sample_period, ROBOTS, LANDMARKS,
+                    output_directory) {
+    initialise();
+  }
+
+  /**
+   * @brief Simulates a reproducible fleet with
+   * FixedDataHandler::TOTAL_ROBOTS robots and
+   * FixedDataHandler::TOTAL_LANDMARKS landmarks.
+   * @param[in] data_points the number of synced datapoints.
+   * @param[in] sample_period the sample period of the simulation [s].
+   * @param[in] seed the seed of the random number generator.
+   * @param[in] output_directory the folder location of the output data.
+   */
+  FixedDataHandler(unsigned long data_points, double sample_period,
+                   std::uint32_t seed, const std::string &output_directory = "")
+      : DataHandler(data_points, sample_period, ROBOTS, LANDMARKS, seed,
+                    output_directory) {
+    initialise();
+  }
+
+  /* Setters */
+
+  using DataHandler::setSimulation;
+
+  /**
+   * @brief Simulates a new fleet, replacing the current data.
+   * @param[in] data_points the number of synced datapoints.
+   * @param[in] sample_period the sample period of the simulation [s].
+   * @param[in] output_directory the folder location of the output data.
+   */
+  void setSimulation(unsigned long data_points, double sample_period,
+                     const std::string &output_directory = "") {
+    DataHandler::setSimulation(data_points, sample_period, ROBOTS, LANDMARKS,
+                               output_directory);
+  }
+
+  /**
+   * @brief Simulates a new reproducible fleet, replacing the current data.
+   * @param[in] data_points the number of synced datapoints.
+   * @param[in] sample_period the sample period of the simulation [s].
+   * @param[in] seed the seed of the random number generator.
+   * @param[in] output_directory the folder location of the output data.
+   */
+  void setSimulation(unsigned long data_points, double sample_period,
+                     std::uint32_t seed,
+                     const std::string &output_directory = "") {
+    DataHandler::setSimulation(data_points, sample_period, ROBOTS, LANDMARKS,
+                               seed, output_directory);
+  }
+
+  /* Getters */
+
+  /**
+   * @brief Getter for the ID of a robot or landmark.
+   * @param[in] barcode the barcode of the robot or landmark.
+   * @return the ID, which is one larger than the index of the robot, or the
+   * index of the landmark plus FixedDataHandler::TOTAL_ROBOTS plus one. If
+   * the barcode is unknown, -1 is returned.
+   */
+  int getID(unsigned short barcode) const override {
+    return barcode < BARCODE_TABLE_SIZE ? id_table_[barcode] : -1;
+  }
+
+  /**
+   * @brief Checks whether an ID belongs to a robot.
+   * @param[in] id the ID returned by FixedDataHandler::getID.
+   */
+  static constexpr bool isRobot(int id) { return id >= 1 && id <= ROBOTS; }
+
+  /**
+   * @brief Checks whether an ID belongs to a landmark.
+   * @param[in] id the ID returned by FixedDataHandler::getID.
+   */
+  static constexpr bool isLandmark(int id) {
+    return id > ROBOTS && id <= TOTAL_BARCODES;
+  }
+
+  /**
+   * @brief Converts a robot ID to its index in DataHandler::getRobots.
+   * @param[in] id the ID of a robot.
+   */
+  static constexpr std::size_t getRobotIndex(int id) { return id - 1; }
+
+  /**
+   * @brief Converts a landmark ID to its index in DataHandler::getLandmarks.
+   * @param[in] id the ID of a landmark.
+   */
+  static constexpr std::size_t getLandmarkIndex(int id) {
+    return id - ROBOTS - 1;
+  }
+
+  /* Multi-threaded Delivery */
+  using DataHandler::fanOutEvents;
+
+  /**
+   * @brief Delivers the synced events of each robot into its own queue. See
+   * DataHandler::fanOutEvents.
+   * @param[in] queues one queue per robot, indexed by robot.
+   * @param[in] include_messages whether a measurement of another robot is also
+   * delivered to the measured robot as an Event::MESSAGE.
+   */
+  void fanOutEvents(const std::array<SpscQueue<Event> *, ROBOTS> &queues,
+                    bool include_messages = true) const {
+    std::array<bool, ROBOTS> delivered{};
+
+    deliverEvents(
+        queues, delivered,
+        [this](unsigned short barcode) {
+          const int subject_ID = FixedDataHandler::getID(barcode);
+          if (!isRobot(subject_ID)) {
+            return -1;
+          }
+          return static_cast<int>(getRobotIndex(subject_ID));
+        },
+        include_messages);
+  }
+
+protected:
+  /**
+   * @brief Throws a std::runtime_error if the fleet does not match the
+   * template parameters.
+   * @param[in] number_of_robots the number of robots about to be loaded.
+   * @param[in] number_of_landmarks the number of landmarks about to be loaded.
+   */
+  void checkFleetSize(unsigned short number_of_robots,
+                      unsigned short number_of_landmarks) const override {
+    if (number_of_robots != ROBOTS || number_of_landmarks != LANDMARKS) {
+      throw std::runtime_error(
+          "Expected " + std::to_string(ROBOTS) + " robots and " +
+          std::to_string(LANDMARKS) + " landmarks, but the data contains " +
+          std::to_string(number_of_robots) + " robots and " +
+          std::to_string(number_of_landmarks) + " landmarks.");
+    }
+  }
+
+  /**
+   * @brief Fills FixedDataHandler::id_table_ from DataHandler::getBarcodes.
+   */
+  void setBarcodeTable() override {
+    id_table_.fill(-1);
+
+    const std::vector<unsigned short> &barcodes = getBarcodes();
+    for (unsigned short i = 0; i < TOTAL_BARCODES; i++) {
+      if (barcodes[i] >= BARCODE_TABLE_SIZE) {
+        throw std::runtime_error("Barcode " + std::to_string(barcodes[i]) +
+                                 " exceeds the size of the barcode table.");
+      }
+      /* Match DataHandler::getID, which returns the first match. */
+      if (-1 == id_table_[barcodes[i]]) {
+        id_table_[barcodes[i]] = i + 1;
+      }
+    }
+  }
+
+private:
+  /**
+   * @brief The ID of each barcode, indexed by barcode. Unused barcodes are -1.
+   */
+  std::array<int, BARCODE_TABLE_SIZE> id_table_;
+
+  /**
+   * @brief Runs the checks of this class on the data loaded by the
+   * DataHandler constructor, which only calls the DataHandler versions.
+   */
+  void initialise() {
+    checkFleetSize(getNumberOfRobots(), getNumberOfLandmarks());
+    setBarcodeTable();
+  }
+};
+
+/**
+ * @brief The fleet of the UTIAS Multi-Robot Cooperative Localisation and
+ * Mapping dataset: 5 robots and 15 landmarks.
+ */
+using UTIASDataHandler = FixedDataHandler<5, 15>;
+
+#endif // INCLUDE_INCLUDE_FIXED_DATA_HANDLER_H_
@@ -0,0 +1,88 @@
+/**
+ * @file NoiseModel.h
+ * @brief Header file of the NoiseModel class.
+ * @author Daniel Ingham
+ * @date 2025-06-18
+ */
+#ifndef INCLUDE_INCLUDE_NOISE_MODEL_H_
+#define INCLUDE_INCLUDE_NOISE_MODEL_H_
+
+#include <cstddef> // std::size_t
+#include <vector>  // std::vector
+
+class DataHandler;
+
+/**
+ * @class NoiseModel
+ * @brief Range and bearing measurement noise binned by the true range and by
+ * the measured subject.
+ * @details Robot::range_error and Robot::bearing_error summarise every
+ * measurement with a single ErrorStatistics, while the noise grows with range
+ * and differs between subjects. This model accumulates the measurement errors
+ * of Robot::error in bins of the groundtruth range for each subject. The
+ * errors are matched to their groundtruth measurements in a single pass over
+ * each robot's measurements. The robots are accumulated in parallel, and
+ * their accumulators are then merged in robot order.
+ *
+ * Besides the bins of each subject, the model holds the statistics of each
+ * range bin over all subjects, of each subject over all ranges, and of all
+ * the measurements. NoiseModel::getNoise returns the most specific of these
+ * that has enough samples, so that a filter can query it for every
+ * measurement.
+ * @note The errors are the groundtruth minus the measured values, and
+ * measurement outliers have already been removed.
+ */
+class NoiseModel {
+public:
+  /**
+   * @brief The statistics of the measurement errors in a bin.
+   */
+  struct Bin {
+    unsigned long count = 0;       ///< The number of measurements.
+    double range_mean = 0.0;       ///< Mean of the range error [m].
+    double range_variance = 0.0;   ///< Sample variance of the range error.
+    double bearing_mean = 0.0;     ///< Mean of the bearing error [rad].
+    double bearing_variance = 0.0; ///< Sample variance of the bearing error.
+  };
+
+  explicit NoiseModel(const DataHandler &, double bin_width = 0.25,
+                      double max_range = 6.0, unsigned int threads = 0);
+
+  const Bin &getNoise(unsigned short, double,
+                      unsigned long minimum_samples = 30) const;
+
+  /* Getters */
+  const Bin &getBin(unsigned short, double) const;
+  const Bin &getRangeBin(double) const;
+  const Bin &getSubjectBin(unsigned short) const;
+  const Bin &getOverall() const;
+
+  std::size_t getBinIndex(double) const;
+  double getBinWidth() const;
+  std::size_t getNumberOfBins() const;
+  unsigned short getNumberOfSubjects() const;
+
+private:
+  double bin_width_;
+  std::size_t total_bins_;
+  unsigned short total_subjects_;
+
+  /**
+   * @brief The subject index of each barcode, indexed by barcode. Unknown
+   * barcodes are -1.
+   */
+  std::vector<int> subject_table_;
+
+  /**
+   * @brief Bins indexed by subject and then range bin.
+   */
+  std::vector<Bin> bins_;
+
+  std::vector<Bin> range_bins_;   ///< Bins of all subjects.
+  std::vector<Bin> subject_bins_; ///< Bins of all ranges.
+  Bin overall_;                   ///< Statistics of all measurements.
+
+  std::size_t getSubjectIndex(unsigned short) const;
+};
+
+#endif // INCLUDE_INCLUDE_NOISE_MODEL_H_
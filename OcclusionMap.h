@@ -0,0 +1,67 @@
+/**
+ * @file OcclusionMap.h
+ * @brief Header file of the OcclusionMap class.
+ * @author Daniel Ingham
+ * @date 2025-06-04
+ */
+#ifndef INCLUDE_INCLUDE_OCCLUSION_MAP_H_
+#define INCLUDE_INCLUDE_OCCLUSION_MAP_H_
+
+#include <cstddef> // std::size_t
+#include <vector>  // std::vector
+
+/**
+ * @class OcclusionMap
+ * @brief Answers line of sight queries against a set of wall segments.
+ * @details The walls are rasterised into a uniform grid, where every cell
+ * lists the walls whose bounding box overlaps it. A line of sight query walks
+ * the cells crossed by the sight line in order (Amanatides and Woo) and only
+ * tests the walls of those cells, so the cost of a query depends on the length
+ * of the sight line rather than on the number of walls.
+ *
+ * The grid cells of coordinates outside the area are clamped to its border.
+ */
+class OcclusionMap {
+public:
+  /**
+   * @struct Wall
+   * @brief A straight wall segment.
+   */
+  struct Wall {
+    double x1; ///< x-coordinate of the first end point [m].
+    double y1; ///< y-coordinate of the first end point [m].
+    double x2; ///< x-coordinate of the second end point [m].
+    double y2; ///< y-coordinate of the second end point [m].
+  };
+
+  OcclusionMap(double, double, double cell_size = 0.5);
+
+  void addWall(const Wall &);
+  void clear();
+
+  bool isBlocked(double, double, double, double) const;
+
+  /* Getters */
+  const std::vector<Wall> &getWalls() const;
+
+private:
+  double width_;
+  double height_;
+  double cell_size_;
+  std::size_t columns_;
+  std::size_t rows_;
+
+  std::vector<Wall> walls_;
+
+  /**
+   * @brief Indices of the walls that may pass through each cell.
+   */
+  std::vector<std::vector<std::size_t>> cells_;
+
+  std::size_t getColumn(double) const;
+  std::size_t getRow(double) const;
+  template <typename Visitor>
+  bool traverse(double, double, double, double, Visitor) const;
+};
+
+#endif // INCLUDE_INCLUDE_OCCLUSION_MAP_H_
@@ -0,0 +1,84 @@
+/**
+ * @file QuantileSketch.h
+ * @brief Header file of the QuantileSketch class.
+ * @author Daniel Ingham
+ * @date 2025-05-28
+ */
+#ifndef INCLUDE_INCLUDE_QUANTILE_SKETCH_H_
+#define INCLUDE_INCLUDE_QUANTILE_SKETCH_H_
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <vector>  // std::vector
+
+/**
+ * @class QuantileSketch
+ * @brief Mergeable, fixed-memory approximation of the distribution of a
+ * stream of values (KLL sketch).
+ * @details Values are added to a hierarchy of compactors. When a compactor
+ * exceeds its capacity it is sorted and every second value is promoted to
+ * the next level, where each value represents twice as many samples. The
+ * capacities shrink geometrically towards the lower levels, so the memory is
+ * bounded by roughly 3k values regardless of the number of samples, while the
+ * rank error of a quantile is of the order of 1/k.
+ *
+ * Sketches built on separate threads can be combined with
+ * QuantileSketch::merge, which gives the same guarantees as a single sketch
+ * of all the values.
+ * @note The compactions use a deterministic pseudo-random sequence, so the
+ * same stream of values always produces the same sketch.
+ */
+class QuantileSketch {
+public:
+  explicit QuantileSketch(unsigned int k = 200);
+
+  void add(double);
+  void merge(const QuantileSketch &);
+
+  /* Getters */
+  double getQuantile(double) const;
+  unsigned long getCount() const;
+  double getMin() const;
+  double getMax() const;
+  std::size_t getNumberOfRetainedValues() const;
+
+private:
+  /**
+   * @brief Capacity parameter of the largest compactor.
+   */
+  unsigned int k_;
+
+  /**
+   * @brief Compactors indexed by level. A value at level h represents 2^h
+   * samples.
+   */
+  std::vector<std::vector<double>> compactors_;
+
+  /**
+   * @brief The capacity of each compactor, which is only recalculated when
+   * the number of levels changes.
+   */
+  std::vector<std::size_t> capacities_;
+
+  std::size_t total_capacity_ = 0; ///< Sum of QuantileSketch::capacities_.
+  std::size_t retained_ = 0;       ///< The number of values held.
+
+  /**
+   * @brief The number of samples added to the sketch.
+   */
+  unsigned long count_ = 0;
+
+  double min_ = 0.0; ///< The smallest sample.
+  double max_ = 0.0; ///< The largest sample.
+
+  /**
+   * @brief State of the xorshift generator used to select the promoted values.
+   */
+  std::uint64_t random_state_ = 0x9E3779B97F4A7C15ULL;
+
+  std::size_t getCapacity(std::size_t) const;
+  void addLevels(std::size_t);
+  void compress();
+};
+
+#endif // INCLUDE_INCLUDE_QUANTILE_SKETCH_H_
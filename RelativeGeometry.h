@@ -0,0 +1,110 @@
+/**
+ * @file RelativeGeometry.h
+ * @brief Header file of the RelativeGeometry class.
+ * @author Daniel Ingham
+ * @date 2025-06-12
+ */
+#ifndef INCLUDE_INCLUDE_RELATIVE_GEOMETRY_H_
+#define INCLUDE_INCLUDE_RELATIVE_GEOMETRY_H_
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+class DataHandler;
+
+/**
+ * @class RelativeGeometry
+ * @brief Groundtruth range and bearing between every pair of robots, and
+ * between every robot and landmark, at every synced time step.
+ * @details The time steps are split into blocks that are calculated in
+ * parallel. Each block reads the groundtruth positions from structure of
+ * arrays copies, so that the inner loops run over contiguous memory.
+ *
+ * The range between two robots is symmetric, so only the pairs i < j are
+ * stored, packed row by row. The direction of robot j from robot i is stored
+ * for the same pairs; the direction of i from j is the opposite direction.
+ * The bearings are then derived from the directions and the robot headings.
+ *
+ * RelativeGeometry::save writes the arrays to a binary file
+ * (little-endian, packed):
+ * - char[8] magic: "UTIASREL".
+ * - uint32 version: RelativeGeometry::VERSION.
+ * - uint32 total_robots (R), uint32 total_landmarks (L).
+ * - uint64 total_timesteps (K).
+ * - double sampling_period [s].
+ * - double[K][R (R - 1) / 2] robot ranges [m].
+ * - double[K][R (R - 1) / 2] robot directions [rad].
+ * - double[K][R] robot orientations [rad].
+ * - double[K][R][L] landmark ranges [m].
+ * - double[K][R][L] landmark bearings [rad].
+ */
+class RelativeGeometry {
+public:
+  /**
+   * @brief Version of the binary file format.
+   */
+  static constexpr std::uint32_t VERSION = 1;
+
+  explicit RelativeGeometry(const DataHandler &, unsigned int threads = 0);
+
+  double getRobotRange(unsigned long, unsigned short, unsigned short) const;
+  double getRobotBearing(unsigned long, unsigned short, unsigned short) const;
+  double getLandmarkRange(unsigned long, unsigned short, unsigned short) const;
+  double getLandmarkBearing(unsigned long, unsigned short,
+                            unsigned short) const;
+
+  const double *getRobotRanges(unsigned long) const;
+  const double *getLandmarkRanges(unsigned long) const;
+
+  void save(const std::string &) const;
+
+  /* Getters */
+  unsigned short getNumberOfRobots() const;
+  unsigned short getNumberOfLandmarks() const;
+  unsigned long getNumberOfTimesteps() const;
+  std::size_t getNumberOfRobotPairs() const;
+  std::size_t getPairIndex(unsigned short, unsigned short) const;
+  std::size_t getMemoryUsage() const;
+
+private:
+  unsigned short total_robots_;
+  unsigned short total_landmarks_;
+  unsigned long total_timesteps_;
+  std::size_t total_pairs_;
+  double sampling_period_;
+
+  /**
+   * @brief Range of each robot pair i < j at each time step [m], indexed by
+   * time step and then by RelativeGeometry::getPairIndex.
+   */
+  std::vector<double> robot_ranges_;
+
+  /**
+   * @brief Direction of robot j from robot i for each pair i < j at each time
+   * step [rad], with the same layout as RelativeGeometry::robot_ranges_.
+   */
+  std::vector<double> robot_directions_;
+
+  /**
+   * @brief Orientation of each robot at each time step [rad].
+   */
+  std::vector<double> orientations_;
+
+  /**
+   * @brief Range of each landmark from each robot at each time step [m],
+   * indexed by time step, robot and then landmark.
+   */
+  std::vector<double> landmark_ranges_;
+
+  /**
+   * @brief Bearing of each landmark from each robot at each time step [rad],
+   * with the same layout as RelativeGeometry::landmark_ranges_.
+   */
+  std::vector<double> landmark_bearings_;
+
+  void checkIndices(unsigned long, unsigned short) const;
+};
+
+#endif // INCLUDE_INCLUDE_RELATIVE_GEOMETRY_H_
@@ -0,0 +1,113 @@
+/**
+ * @file Replayer.h
+ * @brief Header file of the Replayer class.
+ * @author Daniel Ingham
+ * @date 2025-05-19
+ */
+#ifndef INCLUDE_INCLUDE_REPLAYER_H_
+#define INCLUDE_INCLUDE_REPLAYER_H_
+
+#include <atomic>             // std::atomic
+#include <condition_variable> // std::condition_variable
+#include <functional>         // std::function
+#include <mutex>              // std::mutex
+#include <thread>             // std::thread
+#include <vector>             // std::vector
+
+#include "DataHandler.h"
+#include "Event.h"
+
+/**
+ * @class Replayer
+ * @brief Replays the synced dataset as live sensor streams.
+ * @details A single scheduler thread delivers the events returned by
+ * DataHandler::getSyncedEvents at their synced time stamps, scaled by the
+ * replay speed, to the registered callbacks. The delay between the scheduled
+ * and the actual delivery time (jitter), and the delay between the scheduled
+ * time and the callback returning (consumer lag), are recorded so that the
+ * latency of a filter can be measured under realistic load.
+ * @note The callbacks are executed on the scheduler thread, therefore a slow
+ * consumer delays all subsequent events. This is recorded as consumer lag.
+ */
+class Replayer {
+public:
+  /**
+   * @brief Callback invoked for every delivered event.
+   */
+  using Callback = std::function<void(const Event &)>;
+
+  /**
+   * @brief Delivery timing statistics [s].
+   */
+  struct Statistics {
+    unsigned long events = 0; ///< The number of events delivered.
+    double mean_jitter = 0.0; ///< Mean delay of the delivery.
+    double max_jitter = 0.0;  ///< Maximum delay of the delivery.
+    double mean_lag = 0.0;    ///< Mean delay until the callback returned.
+    double max_lag = 0.0;     ///< Maximum delay until the callback returned.
+  };
+
+  explicit Replayer(const DataHandler &, bool include_groundtruth = false);
+  Replayer(const Replayer &) = delete;
+  Replayer &operator=(const Replayer &) = delete;
+  ~Replayer();
+
+  /* Setters */
+  void setSpeed(double);
+  void setCallback(Event::Type, Callback);
+
+  /* Replay control */
+  void start();
+  void stop();
+  void wait();
+  bool isRunning() const;
+
+  /* Getters */
+  Statistics getStatistics() const;
+
+private:
+  /**
+   * @brief The time ordered events to be delivered.
+   */
+  std::vector<Event> events_;
+
+  /**
+   * @brief Whether Replayer::events_ contains the groundtruth states.
+   */
+  bool include_groundtruth_;
+
+  /**
+   * @brief Callbacks indexed by Event::Type.
+   */
+  Callback callbacks_[4];
+
+  /**
+   * @brief Replay speed relative to wall-clock time. A speed of 1 replays in
+   * real time, while a speed of zero delivers the events as fast as possible.
+   */
+  double speed_ = 1.0;
+
+  /**
+   * @brief The scheduler thread.
+   */
+  std::thread scheduler_;
+
+  std::atomic<bool> running_{false};
+  std::atomic<bool> stop_{false};
+
+  /**
+   * @brief Used to interrupt the scheduler while it waits for the next event.
+   */
+  std::mutex stop_mutex_;
+  std::condition_variable stop_condition_;
+
+  /**
+   * @brief Guards Replayer::statistics_.
+   */
+  mutable std::mutex statistics_mutex_;
+  Statistics statistics_;
+
+  void run();
+};
+
+#endif // INCLUDE_INCLUDE_REPLAYER_H_
@@ -7,8 +7,12 @@
 #ifndef INCLUDE_INCLUDE_ROBOT_H_
 #define INCLUDE_INCLUDE_ROBOT_H_
 
-#include <cmath>  // std::atan2
-#include <vector> // std::vector
+#include <cmath>   // std::atan2
+#include <cstddef> // std::size_t
+#include <utility> // std::pair
+#include <vector>  // std::vector
+
+#include "QuantileSketch.h"
 
 /**
  * @class Robot
@@ -171,11 +175,200 @@ public:
   /** @brief Error associated with the angular velocity input. */
   ErrorStatistics angular_velocity_error;
 
+  /**
+   * @brief Joint statistics of the errors of two sensor channels: the forward
+   * and angular velocity, or the range and bearing.
+   */
+  struct ErrorCovariance {
+    unsigned long count = 0;      ///< The number of samples.
+    double first_mean = 0.0;      ///< Mean of the first error.
+    double second_mean = 0.0;     ///< Mean of the second error.
+    double first_variance = 0.0;  ///< Sample variance of the first error.
+    double covariance = 0.0;      ///< Sample covariance of the errors.
+    double second_variance = 0.0; ///< Sample variance of the second error.
+
+    void merge(const ErrorCovariance &);
+  };
+
+  /** @brief Covariance of the forward and angular velocity errors. */
+  ErrorCovariance velocity_error_covariance;
+  /** @brief Covariance of the range and bearing errors. */
+  ErrorCovariance measurement_error_covariance;
+
+  /**
+   * @brief Quantile sketches of the sensor errors.
+   * @details The sketches of different robots or threads can be combined
+   * with ErrorSketches::merge when they have the same size parameter.
+   */
+  struct ErrorSketches {
+    QuantileSketch forward_velocity; ///< Forward velocity error.
+    QuantileSketch angular_velocity; ///< Angular velocity error.
+    QuantileSketch range;            ///< Range error.
+    QuantileSketch bearing;          ///< Bearing error.
+
+    void merge(const ErrorSketches &);
+  };
+
+  /**
+   * @brief Running statistics of the error between the groundtruth and the
+   * states estimated by a filter.
+   * @details The statistics are updated every time a state is reported, so
+   * they are available while the filter is still running.
+   */
+  struct StateErrorStatistics {
+    unsigned long count = 0; ///< The number of reported states.
+
+    double mean_x = 0.0;           ///< The mean x-coordinate error [m].
+    double mean_y = 0.0;           ///< The mean y-coordinate error [m].
+    double mean_orientation = 0.0; ///< The mean orientation error [rad].
+
+    double mean_square_x = 0.0;           ///< Mean squared x error [m^2].
+    double mean_square_y = 0.0;           ///< Mean squared y error [m^2].
+    double mean_square_orientation = 0.0; ///< Mean squared error [rad^2].
+
+    double rmse_x = 0.0;           ///< Root mean squared x error [m].
+    double rmse_y = 0.0;           ///< Root mean squared y error [m].
+    double rmse_orientation = 0.0; ///< Root mean squared error [rad].
+    double rmse_position = 0.0;    ///< Root mean squared distance [m].
+
+    double max_x = 0.0;           ///< The largest absolute x error [m].
+    double max_y = 0.0;           ///< The largest absolute y error [m].
+    double max_orientation = 0.0; ///< The largest absolute error [rad].
+    double max_position = 0.0;    ///< The largest distance error [m].
+  };
+
+  /**
+   * @brief Symmetric covariance of a state estimate. The state is ordered as
+   * x-coordinate, y-coordinate and orientation.
+   */
+  struct Covariance {
+    double xx = 0.0; ///< Variance of the x-coordinate [m^2].
+    double xy = 0.0; ///< Covariance of the x and y-coordinates [m^2].
+    double xo = 0.0; ///< Covariance of the x-coordinate and orientation.
+    double yy = 0.0; ///< Variance of the y-coordinate [m^2].
+    double yo = 0.0; ///< Covariance of the y-coordinate and orientation.
+    double oo = 0.0; ///< Variance of the orientation [rad^2].
+  };
+
+  /**
+   * @brief Symmetric covariance of a range and bearing innovation.
+   */
+  struct InnovationCovariance {
+    double rr = 0.0; ///< Variance of the range innovation [m^2].
+    double rb = 0.0; ///< Covariance of the range and bearing innovations.
+    double bb = 0.0; ///< Variance of the bearing innovation [rad^2].
+  };
+
+  /**
+   * @brief Running consistency statistics of a filter.
+   * @details The Normalised Estimation Error Squared (NEES) of a consistent
+   * filter is chi-square distributed with 3 degrees of freedom, and the
+   * Normalised Innovation Squared (NIS) with 2 degrees of freedom. The
+   * number of samples outside the two-sided 95% chi-square bounds is counted.
+   */
+  struct ConsistencyStatistics {
+    unsigned long nees_count = 0;   ///< The number of NEES samples.
+    double mean_nees = 0.0;         ///< The mean NEES.
+    unsigned long nees_outside = 0; ///< NEES samples outside the bounds.
+
+    unsigned long nis_count = 0;   ///< The number of NIS samples.
+    double mean_nis = 0.0;         ///< The mean NIS.
+    unsigned long nis_outside = 0; ///< NIS samples outside the bounds.
+  };
+
+  /**
+   * @brief Optional covariances of the synced states, populated by a filter.
+   * The covariances are indexed in the same way as Robot::synced states.
+   */
+  std::vector<Covariance> synced_covariances;
+
   void calculateSensorErrror();
   void calculateSampleErrorStats();
   void calculateStateError();
 
+  /* Streaming Quartiles */
+  void setQuantileSketch(unsigned int);
+  unsigned int getQuantileSketchSize() const;
+  const ErrorSketches &getErrorSketches() const;
+  static void calculateQuartiles(const QuantileSketch &, ErrorStatistics &);
+
+  /* Online State Error */
+  void addStateEstimate(unsigned long, const State &);
+  void addStateEstimate(unsigned long, const State &, const Covariance &);
+  void addInnovation(double, double, const InnovationCovariance &);
+  void setStateErrorCapacity(std::size_t);
+  void setCovarianceStorage(bool);
+  void resetStateError();
+  const StateErrorStatistics &getStateErrorStatistics() const;
+  std::vector<State> getStateErrorSeries() const;
+
+  /* Filter Consistency */
+  const ConsistencyStatistics &getConsistencyStatistics() const;
+  const std::vector<double> &getNEESSeries() const;
+
+  static double calculateNEES(const State &, const Covariance &);
+  static double calculateNIS(double, double, const InnovationCovariance &);
+  static std::pair<double, double>
+  getChiSquareBounds(unsigned long, unsigned long samples = 1,
+                     double confidence = 0.95);
+
 private:
+  /**
+   * @brief Running statistics of the state error.
+   */
+  StateErrorStatistics state_error_statistics_;
+
+  /**
+   * @brief Ring buffer holding the most recent reported state errors.
+   */
+  std::vector<State> state_error_series_;
+
+  /**
+   * @brief The maximum number of reported state errors that are buffered. A
+   * capacity of zero disables buffering.
+   */
+  std::size_t state_error_capacity_ = 0;
+
+  /**
+   * @brief Index of the oldest state error once the ring buffer is full.
+   */
+  std::size_t state_error_head_ = 0;
+
+  /**
+   * @brief Running consistency statistics.
+   */
+  ConsistencyStatistics consistency_statistics_;
+
+  /**
+   * @brief The NEES of every synced timestep. Timesteps that have not been
+   * reported with a covariance are NaN.
+   */
+  std::vector<double> nees_series_;
+
+  /**
+   * @brief Whether reported covariances are stored in
+   * Robot::synced_covariances.
+   */
+  bool store_covariances_ = false;
+
+  /**
+   * @brief The size parameter of the error sketches. Zero disables the
+   * sketches, in which case the quartiles are calculated by sorting.
+   */
+  unsigned int sketch_size_ = 0;
+
+  /**
+   * @brief Quantile sketches of the sensor errors, updated as the errors are
+   * calculated.
+   */
+  ErrorSketches error_sketches_;
+
+  State calculateStateError(unsigned long, const State &) const;
+  void checkTimestep(unsigned long) const;
+  void recordStateError(const State &);
+  void accumulateStateError(const State &);
+  void accumulateNEES(unsigned long, double);
+
   unsigned long int calculateMedian(const unsigned long int,
                                     const unsigned long int);
   void calculateQuartiles(const std::vector<double> &, ErrorStatistics &);
@@ -183,6 +376,9 @@ private:
 
   void calculateOdometryError();
   void calculateMeasurementError();
+  void calculateOdometryErrorStats();
+  void calculateMeasurementErrorStats();
+  void calculateErrorCovariance();
 
   void removeOutliers();
 };
@@ -0,0 +1,89 @@
+/**
+ * @file RollingStatistics.h
+ * @brief Header file of the RollingStatistics class.
+ * @author Daniel Ingham
+ * @date 2025-06-16
+ */
+#ifndef INCLUDE_INCLUDE_ROLLING_STATISTICS_H_
+#define INCLUDE_INCLUDE_ROLLING_STATISTICS_H_
+
+#include <cstddef> // std::size_t
+#include <vector>  // std::vector
+
+#include "Robot.h"
+
+class DataHandler;
+
+/**
+ * @class RollingStatistics
+ * @brief Time series of the sensor error statistics of each robot over a
+ * sliding time window.
+ * @details Robot::calculateSampleErrorStats summarises each sensor channel
+ * of a run with a single mean and variance, while the noise of the UTIAS
+ * datasets drifts over a run. This class instead calculates the statistics of
+ * the samples within a trailing time window (t - window, t] at the time of
+ * every sample.
+ *
+ * The sensor errors are sorted by time, so the samples within the window are
+ * a contiguous range of the errors that is advanced at both ends. The mean
+ * and variance are updated in constant time as samples enter and leave the
+ * window. The samples of a series are ranked once by sorting, and the window
+ * is held as a Fenwick tree of counts over the ranks, so that adding or
+ * removing a sample and reading a quartile take O(log n) time for a series of
+ * n samples. The series therefore take O(n log n) time, independently of the
+ * window length.
+ *
+ * The errors are the sensor errors of Robot::error, so measurement outliers
+ * have already been removed. Each robot and channel is calculated in
+ * parallel.
+ */
+class RollingStatistics {
+public:
+  /**
+   * @brief The sensor channels whose errors are summarised.
+   */
+  enum Channel {
+    FORWARD_VELOCITY = 0,
+    ANGULAR_VELOCITY = 1,
+    RANGE = 2,
+    BEARING = 3
+  };
+
+  /**
+   * @brief The statistics of a window.
+   */
+  struct Window {
+    double time = 0.0;       ///< Time of the latest sample in the window [s].
+    unsigned long count = 0; ///< The number of samples in the window.
+
+    /** @brief The statistics of the samples in the window. */
+    Robot::ErrorStatistics statistics;
+  };
+
+  explicit RollingStatistics(const DataHandler &, double window = 10.0,
+                             unsigned int threads = 0);
+
+  /* Getters */
+  const std::vector<Window> &getSeries(unsigned short, Channel) const;
+  const Window &getWindow(unsigned short, Channel, double) const;
+  double getWindowLength() const;
+  unsigned short getNumberOfRobots() const;
+
+private:
+  /**
+   * @brief The number of sensor channels.
+   */
+  static constexpr std::size_t TOTAL_CHANNELS = 4;
+
+  double window_;
+  unsigned short total_robots_;
+
+  /**
+   * @brief The series of windows, indexed by robot and then channel.
+   */
+  std::vector<std::vector<Window>> series_;
+
+  void checkIndices(unsigned short, Channel) const;
+};
+
+#endif // INCLUDE_INCLUDE_ROLLING_STATISTICS_H_
@@ -0,0 +1,190 @@
+/**
+ * @file SharedDataSet.h
+ * @brief Header file of the SharedDataSet class.
+ * @author Daniel Ingham
+ * @date 2025-05-16
+ */
+#ifndef INCLUDE_INCLUDE_SHARED_DATA_SET_H_
+#define INCLUDE_INCLUDE_SHARED_DATA_SET_H_
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <string>  // std::string
+
+#include "Landmark.h"
+#include "Robot.h"
+
+class DataHandler;
+
+/**
+ * @class SharedDataSet
+ * @brief Read-only view of a processed dataset published into a POSIX
+ * shared-memory segment.
+ * @details DataHandler::publishSharedMemory flattens the synced, groundtruth
+ * and error data of every robot into a single segment. All references inside
+ * the segment are byte offsets from the start of the segment, so it can be
+ * mapped at any address. Attaching only maps the segment: no data is parsed
+ * or copied, and all processes attached to the same segment share one
+ * physical copy of the dataset.
+ * @note The raw data is not published, since the filters only operate on the
+ * processed data.
+ */
+class SharedDataSet {
+public:
+  /**
+   * @brief Read-only, contiguous array inside the shared-memory segment.
+   */
+  template <typename T> struct Span {
+    const T *data = nullptr; ///< First element of the array.
+    std::size_t size = 0;    ///< Number of elements in the array.
+
+    /** @brief Element access without bounds checking. */
+    const T &operator[](std::size_t i) const { return data[i]; }
+    /** @brief Iterator to the first element. */
+    const T *begin() const { return data; }
+    /** @brief Iterator past the last element. */
+    const T *end() const { return data + size; }
+  };
+
+  /**
+   * @brief Read-only equivalent of Robot::Measurement.
+   */
+  struct MeasurementView {
+    double time;                   ///< Time stamp of the measurement [s].
+    Span<unsigned short> subjects; ///< The barcodes of the subjects.
+    Span<double> ranges;           ///< The ranges to the subjects [m].
+    Span<double> bearings;         ///< The bearings to the subjects [rad].
+  };
+
+  /**
+   * @brief Selects the Robot::RobotData member to be accessed.
+   */
+  enum Data { SYNCED = 0, GROUNDTRUTH = 1, ERROR = 2 };
+
+  /**
+   * @brief Selects the Robot::ErrorStatistics member to be accessed.
+   */
+  enum Sensor {
+    FORWARD_VELOCITY = 0,
+    ANGULAR_VELOCITY = 1,
+    RANGE = 2,
+    BEARING = 3
+  };
+
+  explicit SharedDataSet(const std::string &);
+  SharedDataSet(SharedDataSet &&) noexcept;
+  SharedDataSet(const SharedDataSet &) = delete;
+  SharedDataSet &operator=(SharedDataSet &&) noexcept;
+  SharedDataSet &operator=(const SharedDataSet &) = delete;
+  ~SharedDataSet();
+
+  static void publish(const DataHandler &, const std::string &);
+  static void remove(const std::string &);
+
+  /* Getters */
+  double getSamplePeriod() const;
+  unsigned short getNumberOfRobots() const;
+  unsigned short getNumberOfLandmarks() const;
+  unsigned short getNumberOfBarcodes() const;
+  unsigned long getNumberOfSyncedDatapoints() const;
+
+  Span<unsigned short> getBarcodes() const;
+  Span<Landmark> getLandmarks() const;
+
+  unsigned short getRobotID(unsigned short) const;
+  unsigned short getRobotBarcode(unsigned short) const;
+  Robot::ErrorStatistics getErrorStatistics(unsigned short, Sensor) const;
+
+  Span<Robot::State> getStates(unsigned short, Data) const;
+  Span<Robot::Odometry> getOdometry(unsigned short, Data) const;
+  std::size_t getNumberOfMeasurements(unsigned short, Data) const;
+  MeasurementView getMeasurement(unsigned short, Data, std::size_t) const;
+
+private:
+  /**
+   * @brief Location of an array relative to the start of the segment.
+   */
+  struct Array {
+    std::uint64_t offset; ///< Byte offset from the start of the segment.
+    std::uint64_t count;  ///< Number of elements.
+  };
+
+  /**
+   * @brief Flattened Robot::Measurement. The subjects, ranges and bearings
+   * are stored in arrays shared by all measurements of the same
+   * Robot::RobotData.
+   */
+  struct Measurement {
+    double time;          ///< Time stamp of the measurement [s].
+    std::uint64_t offset; ///< Index of the first subject.
+    std::uint64_t count;  ///< Number of subjects.
+  };
+
+  /**
+   * @brief Flattened Robot::RobotData.
+   */
+  struct RobotData {
+    Array states;       ///< Robot::State array.
+    Array odometry;     ///< Robot::Odometry array.
+    Array measurements; ///< SharedDataSet::Measurement array.
+    Array subjects;     ///< Subject barcodes of all measurements.
+    Array ranges;       ///< Ranges of all measurements [m].
+    Array bearings;     ///< Bearings of all measurements [rad].
+  };
+
+  /**
+   * @brief Flattened Robot::ErrorStatistics.
+   */
+  struct Statistics {
+    double mean;     ///< The sample mean of the error.
+    double variance; ///< The sample variance of the error.
+    double median;   ///< The sample median of the error.
+    double q1;       ///< The first quartile.
+    double q3;       ///< The third quartile.
+    double iqr;      ///< Inter Quartile Range.
+  };
+
+  /**
+   * @brief Flattened Robot.
+   */
+  struct RobotEntry {
+    std::uint64_t id;         ///< Numerical identifier for the robot.
+    std::uint64_t barcode;    ///< Barcode associated with the robot.
+    Statistics statistics[4]; ///< Indexed by SharedDataSet::Sensor.
+    RobotData data[3];        ///< Indexed by SharedDataSet::Data.
+  };
+
+  /**
+   * @brief Header at the start of the segment.
+   */
+  struct Header {
+    char magic[8];          ///< Set once the segment is complete.
+    std::uint64_t version;  ///< Layout version.
+    std::uint64_t size;     ///< Total segment size [bytes].
+    double sampling_period; ///< Resampling period [s].
+    std::uint64_t total_synced_datapoints; ///< Synced datapoints per robot.
+    std::uint64_t total_robots;            ///< Number of robots.
+    std::uint64_t total_landmarks;         ///< Number of landmarks.
+    std::uint64_t total_barcodes;          ///< Number of barcodes.
+    Array barcodes;  ///< Barcode array.
+    Array landmarks; ///< Landmark array.
+    Array robots;    ///< SharedDataSet::RobotEntry array.
+  };
+
+  /**
+   * @brief Start of the read-only mapping of the segment.
+   */
+  const unsigned char *segment_ = nullptr;
+
+  /**
+   * @brief Size of the mapping [bytes].
+   */
+  std::size_t size_ = 0;
+
+  const Header &getHeader() const;
+  const RobotEntry &getRobot(unsigned short) const;
+
+  template <typename T> Span<T> getSpan(const Array &) const;
+};
+
+#endif // INCLUDE_INCLUDE_SHARED_DATA_SET_H_
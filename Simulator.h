@@ -8,9 +8,13 @@
 #define INCLUDE_INCLUDE_SIMULATOR_H_
 
 #include "Landmark.h"
+#include "OcclusionMap.h"
 #include "Robot.h"
+#include "SpatialHash.h"
 
 #include <cmath>
+#include <cstdint>
+#include <map>
 #include <random>
 #include <vector>
 
@@ -20,6 +24,38 @@
  */
 class Simulator {
 public:
+  /**
+   * @struct SensorModel
+   * @brief Sampling characteristics of the sensors of a robot, which are used
+   * to simulate raw, asynchronous data.
+   */
+  struct SensorModel {
+    double groundtruth_period = 0.01; ///< Groundtruth sample period [s].
+    double odometry_period = 0.02;    ///< Odometry sample period [s].
+    double measurement_period = 0.1;  ///< Measurement sample period [s].
+
+    /**
+     * @brief Fractional spread of the odometry and measurement periods between
+     * robots. Each robot's periods are scaled by a uniform random factor in
+     * [1 - rate_variation, 1 + rate_variation], so it must be in [0, 1).
+     */
+    double rate_variation = 0.0;
+
+    /**
+     * @brief Probabilities of a lost odometry sample and of a missed
+     * detection, in [0, 1). A probability of one would leave the robot
+     * without any odometry or measurements, which the sensor errors require.
+     */
+    double odometry_dropout = 0.0;
+    double measurement_dropout = 0.0; ///< See SensorModel::odometry_dropout.
+
+    /**
+     * @brief Standard deviation of the error of the odometry and measurement
+     * timestamps [s].
+     */
+    double timestamp_jitter = 0.0;
+  };
+
   Simulator();
   Simulator(const unsigned long int, double, std::vector<Robot> &,
             std::vector<Landmark> &, std::vector<unsigned short int> &);
@@ -29,10 +65,66 @@ public:
   void setSimulation(const unsigned long int, double, std::vector<Robot> &,
                      std::vector<Landmark> &,
                      std::vector<unsigned short int> &);
+  void setSeed(std::uint32_t, unsigned long stream = 0);
+  void setLandmarkLayout(const std::vector<Landmark> &);
+  void setCollisionAvoidance(bool, double distance = 0.6);
+  void setOcclusion(bool, double robot_radius = 0.2);
+  void setSensorModel(const SensorModel &);
+  void setSensorModel(unsigned short, const SensorModel &);
+  void clearSensorModel();
+  void addWall(double, double, double, double);
+  void clearWalls();
+
+  /* Getters */
+  bool hasSensorModel() const;
 
 private:
   /* Random Setup and seeding. */
   std::mt19937 generator;
+
+  /**
+   * @brief Landmarks reused by every simulation instead of generating new
+   * positions. Empty if the positions are generated.
+   */
+  std::vector<Landmark> landmark_layout_;
+
+  /**
+   * @brief Steer the robots around other robots and landmarks ahead of them.
+   */
+  bool collision_avoidance_ = false;
+
+  /**
+   * @brief The distance [m] within which obstacles ahead of a robot are
+   * avoided.
+   */
+  double avoidance_distance_ = 0.6;
+
+  /**
+   * @brief Robots and walls block the line of sight of the measurements.
+   */
+  bool occlusion_ = false;
+
+  /**
+   * @brief The radius [m] of the disc that a robot occludes.
+   */
+  double robot_radius_ = 0.2;
+
+  /**
+   * @brief Simulate raw data with Simulator::sensor_model_ instead of synced
+   * data.
+   */
+  bool raw_data_ = false;
+
+  /**
+   * @brief The sensor model of every robot without its own model.
+   */
+  SensorModel sensor_model_;
+
+  /**
+   * @brief Sensor models of individual robots, indexed by robot index.
+   */
+  std::map<unsigned short, SensorModel> robot_sensor_models_;
+
   /**
    * @ brief The total number of samples for each robot in the simulation.
    */
@@ -94,6 +186,11 @@ private:
         0.35f; ///< Maximum angular velocity [rad/s] (2.3 Odometry: page 970)
   } limits_;
 
+  /**
+   * @brief Walls that block the line of sight of the measurements.
+   */
+  OcclusionMap occlusion_map_{limits_.width, limits_.height};
+
   /**
    * @brief allows for easier acces of the items in the limits_ struct.
    */
@@ -115,8 +212,17 @@ private:
   void setErrorStatistics();
   void setRobotsInitalState();
   void setRobotOdometryAndState();
+  void avoidCollisions(const std::vector<double> &, const std::vector<double> &,
+                       const std::vector<double> &, const std::vector<double> &,
+                       const SpatialHash &, const SpatialHash &,
+                       std::vector<double> &, std::vector<double> &) const;
   void setRobotMeasurement();
+  bool isOccluded(unsigned short, std::size_t, double, double,
+                  const std::vector<std::size_t> &, const std::vector<double> &,
+                  const std::vector<double> &) const;
   void addGaussianNoise();
+  void setRawData();
+  static void checkSensorModel(const SensorModel &);
 };
 
 #endif // INCLUDE_INCLUDE_SIMULATOR_H_
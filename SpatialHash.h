@@ -0,0 +1,62 @@
+/**
+ * @file SpatialHash.h
+ * @brief Header file of the SpatialHash class.
+ * @author Daniel Ingham
+ * @date 2025-06-02
+ */
+#ifndef INCLUDE_INCLUDE_SPATIAL_HASH_H_
+#define INCLUDE_INCLUDE_SPATIAL_HASH_H_
+
+#include <cstddef> // std::size_t
+#include <vector>  // std::vector
+
+/**
+ * @class SpatialHash
+ * @brief Uniform grid that finds the points within a radius of a position
+ * without comparing every pair of points.
+ * @details The area is divided into square cells and every point is hashed to
+ * the cell containing it. SpatialHash::build sorts the points by cell with a
+ * counting sort, so that the points of a cell are contiguous in memory.
+ * Rebuilding the hash is linear in the number of points, and a query only
+ * inspects the cells overlapping the search radius. With a cell size equal
+ * to the search radius, this is the 3x3 block of cells around the position.
+ *
+ * Points outside the area are clamped to the cells on its border, so they
+ * are still found, although the queries near the border become slower.
+ */
+class SpatialHash {
+public:
+  SpatialHash(double, double, double);
+
+  void build(const std::vector<double> &, const std::vector<double> &);
+  void query(double, double, double, std::vector<std::size_t> &) const;
+
+  /* Getters */
+  double getCellSize() const;
+  std::size_t getNumberOfCells() const;
+  std::size_t getNumberOfPoints() const;
+
+private:
+  double cell_size_;
+  std::size_t columns_;
+  std::size_t rows_;
+
+  /**
+   * @brief Index of the first point of each cell in SpatialHash::points_. The
+   * points of cell c are in the range [cell_start_[c], cell_start_[c + 1]).
+   */
+  std::vector<std::size_t> cell_start_;
+
+  /**
+   * @brief Point indices sorted by cell.
+   */
+  std::vector<std::size_t> points_;
+
+  std::vector<double> x_; ///< Point x-coordinates [m].
+  std::vector<double> y_; ///< Point y-coordinates [m].
+
+  std::size_t getColumn(double) const;
+  std::size_t getRow(double) const;
+};
+
+#endif // INCLUDE_INCLUDE_SPATIAL_HASH_H_
@@ -0,0 +1,188 @@
+/**
+ * @file SpscQueue.h
+ * @brief Header file of the SpscQueue class template.
+ * @author Daniel Ingham
+ * @date 2025-05-23
+ */
+#ifndef INCLUDE_INCLUDE_SPSC_QUEUE_H_
+#define INCLUDE_INCLUDE_SPSC_QUEUE_H_
+
+#include <atomic>    // std::atomic
+#include <cstddef>   // std::size_t
+#include <memory>    // std::unique_ptr
+#include <stdexcept> // std::runtime_error
+#include <thread>    // std::this_thread::yield
+
+/**
+ * @class SpscQueue
+ * @brief Bounded, lock-free single-producer/single-consumer ring buffer.
+ * @details Exactly one thread may push and exactly one thread may pop. The
+ * capacity is rounded up to a power of two, so that the ring index is a mask
+ * rather than a division. The producer and consumer indices live on separate
+ * cache lines, and each side keeps a cached copy of the other side's index so
+ * that the shared index is only re-read when the queue appears full or empty.
+ *
+ * The producer signals the end of the stream with SpscQueue::close. The
+ * consumer has received every element once SpscQueue::pop returns false.
+ * @tparam T the element type, which must be default constructible and copy
+ * assignable.
+ */
+template <typename T> class SpscQueue {
+public:
+  /**
+   * @brief Constructor that allocates the ring buffer.
+   * @param[in] capacity the minimum number of elements the queue can hold.
+   */
+  explicit SpscQueue(std::size_t capacity) {
+    if (capacity == 0) {
+      throw std::runtime_error("The queue capacity must be greater than zero.");
+    }
+
+    std::size_t size = 1;
+    while (size < capacity) {
+      size <<= 1;
+    }
+
+    mask_ = size - 1;
+    buffer_.reset(new T[size]);
+  }
+
+  SpscQueue(const SpscQueue &) = delete;
+  SpscQueue &operator=(const SpscQueue &) = delete;
+
+  /**
+   * @brief Appends an element without blocking. Producer only.
+   * @param[in] value the element to be appended.
+   * @return false if the queue is full.
+   */
+  bool tryPush(const T &value) {
+    const std::size_t tail = tail_.load(std::memory_order_relaxed);
+
+    if (tail - cached_head_ > mask_) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      if (tail - cached_head_ > mask_) {
+        return false;
+      }
+    }
+
+    buffer_[tail & mask_] = value;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Appends an element, yielding while the queue is full. Producer
+   * only.
+   * @param[in] value the element to be appended.
+   */
+  void push(const T &value) {
+    while (!tryPush(value)) {
+      std::this_thread::yield();
+    }
+  }
+
+  /**
+   * @brief Removes the oldest element without blocking. Consumer only.
+   * @param[out] value the removed element.
+   * @return false if the queue is empty.
+   */
+  bool tryPop(T &value) {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+
+    if (head == cached_tail_) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      if (head == cached_tail_) {
+        return false;
+      }
+    }
+
+    value = buffer_[head & mask_];
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Removes the oldest element, yielding while the queue is empty.
+   * Consumer only.
+   * @param[out] value the removed element.
+   * @return false if the queue is empty and has been closed by the producer.
+   */
+  bool pop(T &value) {
+    while (!tryPop(value)) {
+      if (closed_.load(std::memory_order_acquire)) {
+        /* Elements pushed before the queue was closed are still delivered. */
+        return tryPop(value);
+      }
+      std::this_thread::yield();
+    }
+    return true;
+  }
+
+  /**
+   * @brief Marks the end of the stream. Producer only.
+   */
+  void close() { closed_.store(true, std::memory_order_release); }
+
+  /**
+   * @brief Getter for the state of the stream.
+   * @return true if the producer has closed the queue.
+   */
+  bool isClosed() const { return closed_.load(std::memory_order_acquire); }
+
+  /**
+   * @brief Getter for the capacity of the queue.
+   */
+  std::size_t getCapacity() const { return mask_ + 1; }
+
+  /**
+   * @brief Getter for the number of queued elements.
+   * @note The value is only a snapshot when the queue is in use.
+   */
+  std::size_t getSize() const {
+    return tail_.load(std::memory_order_acquire) -
+           head_.load(std::memory_order_acquire);
+  }
+
+private:
+  /**
+   * @brief Size of a cache line [bytes].
+   */
+  static constexpr std::size_t CACHE_LINE = 64;
+
+  /**
+   * @brief The ring buffer.
+   */
+  std::unique_ptr<T[]> buffer_;
+
+  /**
+   * @brief Capacity minus one, used to wrap the indices.
+   */
+  std::size_t mask_ = 0;
+
+  /**
+   * @brief Index of the next element to be popped, written by the consumer.
+   */
+  alignas(CACHE_LINE) std::atomic<std::size_t> head_{0};
+
+  /**
+   * @brief The consumer's copy of SpscQueue::tail_.
+   */
+  std::size_t cached_tail_ = 0;
+
+  /**
+   * @brief Index of the next element to be pushed, written by the producer.
+   */
+  alignas(CACHE_LINE) std::atomic<std::size_t> tail_{0};
+
+  /**
+   * @brief The producer's copy of SpscQueue::head_.
+   */
+  std::size_t cached_head_ = 0;
+
+  /**
+   * @brief Set by the producer after the last element has been pushed.
+   */
+  alignas(CACHE_LINE) std::atomic<bool> closed_{false};
+};
+
+#endif // INCLUDE_INCLUDE_SPSC_QUEUE_H_
@@ -0,0 +1,146 @@
+/**
+ * @file StreamServer.h
+ * @brief Header file of the StreamServer class.
+ * @author Daniel Ingham
+ * @date 2025-05-21
+ */
+#ifndef INCLUDE_INCLUDE_STREAM_SERVER_H_
+#define INCLUDE_INCLUDE_STREAM_SERVER_H_
+
+#include <atomic>  // std::atomic
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint8_t
+#include <mutex>   // std::mutex
+#include <string>  // std::string
+#include <thread>  // std::thread
+#include <vector>  // std::vector
+
+#include "DataHandler.h"
+#include "Event.h"
+
+/**
+ * @class StreamServer
+ * @brief Serves the synced dataset to external processes over a Unix domain
+ * socket or a localhost TCP socket.
+ * @details Every client that connects receives the complete, time ordered
+ * event stream of the dataset on its own thread. The stream starts with a
+ * stream header, followed by one frame per event and an end frame:
+ *
+ * Stream header (little-endian, packed):
+ * - char[8] magic: "UTIASSTR".
+ * - uint32 version: StreamServer::VERSION.
+ * - uint32 total_robots.
+ * - double sampling_period [s].
+ * - uint64 total_events: number of event frames that follow.
+ * - uint16[2] per robot: the robot ID and barcode.
+ *
+ * Frame (little-endian, packed):
+ * - uint8 type: Event::Type, or StreamServer::END.
+ * - uint8 reserved: zero.
+ * - uint16 robot: index of the robot.
+ * - uint32 payload: size of the payload [bytes].
+ * - double time: synced time stamp [s].
+ * - payload:
+ *   - Event::ODOMETRY: double forward_velocity, double angular_velocity.
+ *   - Event::MEASUREMENT and Event::MESSAGE: uint32 count, uint16[count]
+ *     subjects, double[count] ranges, double[count] bearings.
+ *   - Event::GROUNDTRUTH: double x, double y, double orientation.
+ *   - StreamServer::END: empty.
+ *
+ * Frames are batched into writes of StreamServer::setBatchSize bytes. The
+ * sockets are blocking, so a client that does not keep up stalls its own
+ * stream rather than growing a buffer in the server (back-pressure). Other
+ * clients are not affected.
+ * @note The DataHandler must outlive the server.
+ */
+class StreamServer {
+public:
+  /**
+   * @brief Version of the binary framing.
+   */
+  static constexpr std::uint32_t VERSION = 1;
+
+  /**
+   * @brief Frame type that terminates the stream.
+   */
+  static constexpr std::uint8_t END = 255;
+
+  explicit StreamServer(const DataHandler &, bool include_groundtruth = true);
+  StreamServer(const StreamServer &) = delete;
+  StreamServer &operator=(const StreamServer &) = delete;
+  ~StreamServer();
+
+  /* Setup */
+  void listenUnix(const std::string &);
+  void listenTCP(unsigned short port = 0);
+  void setBatchSize(std::size_t);
+
+  /* Server control */
+  void start();
+  void stop();
+
+  /* Getters */
+  unsigned short getPort() const;
+  unsigned long getNumberOfClients() const;
+
+private:
+  /**
+   * @brief The dataset being served.
+   */
+  const DataHandler &data_;
+
+  /**
+   * @brief The time ordered events sent to every client.
+   */
+  std::vector<Event> events_;
+
+  /**
+   * @brief The number of bytes buffered before they are written to a client.
+   */
+  std::size_t batch_size_ = 64 * 1024;
+
+  /**
+   * @brief The listening socket, or -1 if the server is not listening.
+   */
+  int listen_socket_ = -1;
+
+  /**
+   * @brief Path of the Unix domain socket, which is unlinked on stop.
+   */
+  std::string socket_path_;
+
+  /**
+   * @brief The bound localhost TCP port.
+   */
+  unsigned short port_ = 0;
+
+  std::atomic<bool> stop_{false};
+  std::thread acceptor_;
+
+  /**
+   * @brief Guards the client sockets and threads.
+   */
+  mutable std::mutex clients_mutex_;
+  std::vector<int> client_sockets_;
+  std::vector<std::thread> client_threads_;
+
+  /**
+   * @brief The client threads that have finished their stream, which are
+   * joined when the next client is accepted or the server is stopped.
+   */
+  std::vector<std::thread::id> finished_clients_;
+
+  /**
+   * @brief The number of clients that have connected.
+   */
+  std::atomic<unsigned long> total_clients_{0};
+
+  void acceptClients();
+  void serveClient(int);
+  void reapClients(std::vector<std::thread> &);
+  void encodeHeader(std::vector<char> &) const;
+  void encodeEvent(const Event &, std::vector<char> &) const;
+  bool sendBuffer(int, std::vector<char> &) const;
+};
+
+#endif // INCLUDE_INCLUDE_STREAM_SERVER_H_
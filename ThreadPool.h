@@ -0,0 +1,107 @@
+/**
+ * @file ThreadPool.h
+ * @brief Header file of the ThreadPool class.
+ * @author Daniel Ingham
+ * @date 2025-05-12
+ */
+#ifndef INCLUDE_INCLUDE_THREAD_POOL_H_
+#define INCLUDE_INCLUDE_THREAD_POOL_H_
+
+#include <atomic>             // std::atomic
+#include <condition_variable> // std::condition_variable
+#include <cstddef>            // std::size_t
+#include <deque>              // std::deque
+#include <functional>         // std::function
+#include <future>             // std::future, std::packaged_task
+#include <memory>             // std::shared_ptr, std::unique_ptr
+#include <mutex>              // std::mutex
+#include <thread>             // std::thread
+#include <type_traits>        // std::invoke_result_t
+#include <vector>             // std::vector
+
+/**
+ * @class ThreadPool
+ * @brief Bounded work-stealing thread pool used to process datasets and
+ * simulations concurrently.
+ * @details Every worker owns a task queue. Tasks submitted from a worker are
+ * pushed onto that worker's own queue and popped in last-in-first-out order,
+ * while idle workers steal the oldest tasks from the other queues. Threads
+ * that call ThreadPool::parallelFor execute the iterations of their own call
+ * that no worker has claimed, which allows nested parallelism (e.g. robot
+ * level tasks inside a dataset level task) without deadlocking the pool.
+ */
+class ThreadPool {
+public:
+  explicit ThreadPool(unsigned int threads = 0);
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  ~ThreadPool();
+
+  /**
+   * @brief Schedules a callable on the pool.
+   * @param[in] function the callable to be executed.
+   * @return a std::future holding the result of the callable.
+   */
+  template <typename Function>
+  std::future<std::invoke_result_t<Function>> submit(Function &&function) {
+    using Result = std::invoke_result_t<Function>;
+
+    /* std::function requires a copyable target, therefore the packaged task is
+     * shared. */
+    auto task = std::make_shared<std::packaged_task<Result()>>(
+        std::forward<Function>(function));
+    std::future<Result> result = task->get_future();
+
+    push([task]() { (*task)(); });
+    return result;
+  }
+
+  void parallelFor(std::size_t, const std::function<void(std::size_t)> &);
+
+  unsigned int getNumberOfThreads() const;
+
+private:
+  /**
+   * @brief The task queue owned by a single worker.
+   */
+  struct Queue {
+    std::mutex mutex;                        ///< Guards the task deque.
+    std::deque<std::function<void()>> tasks; ///< Pending tasks.
+  };
+
+  /**
+   * @brief One queue per worker thread.
+   */
+  std::vector<std::unique_ptr<Queue>> queues_;
+
+  /**
+   * @brief The worker threads.
+   */
+  std::vector<std::thread> threads_;
+
+  /**
+   * @brief The number of tasks that have been pushed but not yet popped.
+   */
+  std::atomic<std::size_t> pending_{0};
+
+  /**
+   * @brief Round-robin index used when tasks are submitted from threads that
+   * are not part of the pool.
+   */
+  std::atomic<std::size_t> next_queue_{0};
+
+  /**
+   * @brief Set by the destructor to signal the workers to exit once all
+   * pending tasks have been completed.
+   */
+  bool stop_ = false;
+
+  std::mutex wake_mutex_;
+  std::condition_variable wake_;
+
+  void push(std::function<void()>);
+  bool runPendingTask();
+  void workerLoop(std::size_t);
+};
+
+#endif // INCLUDE_INCLUDE_THREAD_POOL_H_
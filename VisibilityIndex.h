@@ -0,0 +1,105 @@
+/**
+ * @file VisibilityIndex.h
+ * @brief Header file of the VisibilityIndex class.
+ * @author Daniel Ingham
+ * @date 2025-06-14
+ */
+#ifndef INCLUDE_INCLUDE_VISIBILITY_INDEX_H_
+#define INCLUDE_INCLUDE_VISIBILITY_INDEX_H_
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <vector>  // std::vector
+
+class DataHandler;
+
+/**
+ * @class VisibilityIndex
+ * @brief Records which robots and landmarks each robot could see at every
+ * synced time step according to the groundtruth, and which it detected.
+ * @details A subject is visible if it is within the maximum range and field
+ * of view of the robot's measurement sensor. The landmarks within range are
+ * found with a SpatialHash, so only nearby landmarks are tested. A subject is
+ * detected if its barcode is in the robot's synced measurements.
+ *
+ * The subjects are indexed by their ID minus one (see DataHandler::getID):
+ * the robots first, followed by the landmarks. The visible and detected
+ * subjects of each robot and time step are stored as bitsets, one bit per
+ * subject, so that the comparison of the two sets is a handful of word
+ * operations.
+ *
+ * A missed detection is a visible subject that was not detected at a time
+ * step at which the robot took a measurement. Time steps without any
+ * measurement are not counted, since the measurement sensor is slower than
+ * the synced sample rate. A false detection is a detected subject that was not
+ * visible, which usually indicates a data association error.
+ */
+class VisibilityIndex {
+public:
+  VisibilityIndex(const DataHandler &, double max_range = 4.0,
+                  double field_of_view = 0.52, unsigned int threads = 0);
+
+  bool isVisible(unsigned long, unsigned short, unsigned short) const;
+  bool isDetected(unsigned long, unsigned short, unsigned short) const;
+  bool isMeasured(unsigned long, unsigned short) const;
+
+  std::vector<unsigned short> getVisibleSubjects(unsigned long,
+                                                 unsigned short) const;
+  std::vector<unsigned long> getVisibleTicks(unsigned short,
+                                             unsigned short) const;
+
+  unsigned long getVisibleCount(unsigned short, unsigned short) const;
+  unsigned long getMissedDetections(unsigned short, unsigned short) const;
+  unsigned long getMissedDetections(unsigned short) const;
+  unsigned long getFalseDetections(unsigned short, unsigned short) const;
+  unsigned long getFalseDetections(unsigned short) const;
+
+  /* Getters */
+  double getMaxRange() const;
+  double getFieldOfView() const;
+  unsigned short getNumberOfRobots() const;
+  unsigned short getNumberOfSubjects() const;
+  unsigned long getNumberOfTimesteps() const;
+  std::size_t getMemoryUsage() const;
+
+private:
+  double max_range_;
+  double field_of_view_;
+  unsigned short total_robots_;
+  unsigned short total_subjects_;
+  unsigned long total_timesteps_;
+
+  /**
+   * @brief The number of 64-bit words in the bitset of a robot and time step.
+   */
+  std::size_t words_;
+
+  /**
+   * @brief Visible subjects, indexed by robot, time step and then word.
+   */
+  std::vector<std::uint64_t> visible_;
+
+  /**
+   * @brief Detected subjects, with the same layout as
+   * VisibilityIndex::visible_.
+   */
+  std::vector<std::uint64_t> detected_;
+
+  /**
+   * @brief Whether each robot took a measurement at each time step, indexed
+   * by robot and then time step.
+   */
+  std::vector<char> measured_;
+
+  /**
+   * @brief Counts per robot and subject, indexed by robot and then subject.
+   */
+  std::vector<unsigned long> visible_counts_;
+  std::vector<unsigned long> missed_counts_; ///< Missed detections.
+  std::vector<unsigned long> false_counts_;  ///< False detections.
+
+  std::size_t getWord(unsigned long, unsigned short) const;
+  void checkIndices(unsigned long, unsigned short, unsigned short) const;
+};
+
+#endif // INCLUDE_INCLUDE_VISIBILITY_INDEX_H_